@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*!
+ * \file ia_pal_types_isp_parameters_size.h
+ * \brief Compile-time size and alignment of the ia_pal_isp_* parameter structs, keyed by ia_pal_uuid.
+ *
+ * The table describes the parameter structs declared in ia_pal_types_isp_parameters_autogen.h.
+ * It does not describe the encoded HW payload, which is still reported by
+ * IntelCCA::getPacOutputSize(). Kernels sharing one parameter struct (e.g. the *_1_4 IFD/ODR
+ * terminals and ia_pal_isp_io_buffer_1_4_t) map to the same struct. UUIDs without a parameter
+ * struct report size 0.
+ *
+ * IA_PAL_ISP_PARAMETERS_LIST is maintained by hand against ia_pal_types_isp_ids_autogen.h and
+ * ia_pal_types_isp_parameters_autogen.h. Re-check it whenever either autogen header is updated.
+ * The following UUIDs have no parameter struct and are intentionally not listed:
+ * ia_pal_uuid_isp_b2i_ds_output_1_1, ia_pal_uuid_isp_sw_scaler, ia_pal_uuid_isp_gdc_sp,
+ * ia_pal_uuid_isp_is_odr_a, ia_pal_uuid_isp_is_odr_b, ia_pal_uuid_isp_is_odr_c and
+ * ia_pal_uuid_isp_tnr_sp_mc2.
+ */
+
+#ifndef IA_PAL_TYPES_ISP_PARAMETERS_SIZE_H
+#define IA_PAL_TYPES_ISP_PARAMETERS_SIZE_H
+
+#include <stdint.h>
+#include "ia_pal_types_isp_ids_autogen.h"
+#include "ia_pal_types_isp_parameters_autogen.h"
+
+/*!
+ * \brief X-macro list of (ia_pal_uuid, parameter struct type) pairs.
+ * ENTRY(uuid, type) is expanded once per kernel.
+ */
+#define IA_PAL_ISP_PARAMETERS_LIST(ENTRY) \
+    ENTRY(ia_pal_uuid_isp_acm_1_2, ia_pal_isp_acm_1_2_t) \
+    ENTRY(ia_pal_uuid_isp_aestatistics_2_1, ia_pal_isp_aestatistics_2_1_t) \
+    ENTRY(ia_pal_uuid_isp_b2i_ds_1_1, ia_pal_isp_b2i_ds_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_bgb_1_0, ia_pal_isp_bgb_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_bnlm_3_4, ia_pal_isp_bnlm_3_4_t) \
+    ENTRY(ia_pal_uuid_isp_bxt_blc, ia_pal_isp_bxt_blc_t) \
+    ENTRY(ia_pal_uuid_isp_bxt_demosaic, ia_pal_isp_bxt_demosaic_t) \
+    ENTRY(ia_pal_uuid_isp_cas_1_1, ia_pal_isp_cas_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_ccm_3a_2_0, ia_pal_isp_ccm_3a_2_0_t) \
+    ENTRY(ia_pal_uuid_isp_crop_bpp_adjust_1_0, ia_pal_isp_crop_bpp_adjust_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_csc_1_1, ia_pal_isp_csc_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_dol_lite_1_2, ia_pal_isp_dol_lite_1_2_t) \
+    ENTRY(ia_pal_uuid_isp_dpc_2_2, ia_pal_isp_dpc_2_2_t) \
+    ENTRY(ia_pal_uuid_isp_fr_grid_1_0, ia_pal_isp_fr_grid_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_gammatm_v4, ia_pal_isp_gammatm_v4_t) \
+    ENTRY(ia_pal_uuid_isp_gd_2_2, ia_pal_isp_gd_2_2_t) \
+    ENTRY(ia_pal_uuid_isp_gd_dpc_2_1, ia_pal_isp_gd_dpc_2_1_t) \
+    ENTRY(ia_pal_uuid_isp_gdc7, ia_pal_isp_gdc7_t) \
+    ENTRY(ia_pal_uuid_isp_gdc7_1, ia_pal_isp_gdc7_1_t) \
+    ENTRY(ia_pal_uuid_isp_glim_2_0, ia_pal_isp_glim_2_0_t) \
+    ENTRY(ia_pal_uuid_isp_gltm_2_0, ia_pal_isp_gltm_2_0_t) \
+    ENTRY(ia_pal_uuid_isp_gmv_statistics_1_1, ia_pal_isp_gmv_statistics_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_pipe_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_pipe_long_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_pipe_short_smth_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_pdaf_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_lsc_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_bnlm_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_pdaf_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_awb_sat_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_awb_sve_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_awb_std_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_ae_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_af_std_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_ir_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_burst_isp_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_gmv_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_gmv_feature_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_gmv_match_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_lbff_crop_espa_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_segmap_bnlm_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_segmap_xnr_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_segmap_acm_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_segmap_tnr_bc_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_segmap_tnr_blend_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_segmap_cas_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_tnr_sp_bc_yuv4nm1_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_tnr_sp_bc_rs4nm1_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_tnr_sp_bc_rs4n_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_tnr_fp_blend_yuvnm1_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_tnr_fp_yuvn_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_tnr_scale_fp_yuv4n_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_ofs_mp_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_ofs_dp_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_bgmap_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_ifd_bg_yuv_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_odr_dpc_pdaf_1_4, ia_pal_isp_io_buffer_1_4_t) \
+    ENTRY(ia_pal_uuid_isp_isys_drainer_1_0, ia_pal_isp_isys_drainer_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_linearization2_0, ia_pal_isp_linearization2_0_t) \
+    ENTRY(ia_pal_uuid_isp_lsc_1_2, ia_pal_isp_lsc_1_2_t) \
+    ENTRY(ia_pal_uuid_isp_nntm_1_0, ia_pal_isp_nntm_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_pafstatistics_1_2, ia_pal_isp_pafstatistics_1_2_t) \
+    ENTRY(ia_pal_uuid_isp_pext_1_0, ia_pal_isp_pext_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_rgb_ir_2_0, ia_pal_isp_rgb_ir_2_0_t) \
+    ENTRY(ia_pal_uuid_isp_rgbs_grid_1_1, ia_pal_isp_rgbs_grid_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_smurf_bnlm_1_0, ia_pal_isp_smurf_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_smurf_xnr_1_0, ia_pal_isp_smurf_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_smurf_acm_1_0, ia_pal_isp_smurf_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_smurf_tnr_bc_1_0, ia_pal_isp_smurf_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_smurf_tnr_blend_1_0, ia_pal_isp_smurf_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_smurf_cas_1_0, ia_pal_isp_smurf_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_tnr_scaler_lb_1_1, ia_pal_isp_tnr_scaler_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_tnr_scaler_fp_1_1, ia_pal_isp_tnr_scaler_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_tnr7_bc_1_2, ia_pal_isp_tnr7_bc_1_2_t) \
+    ENTRY(ia_pal_uuid_isp_tnr7_blend_1_1, ia_pal_isp_tnr7_blend_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_tnr7_ims_1_2, ia_pal_isp_tnr7_ims_1_2_t) \
+    ENTRY(ia_pal_uuid_isp_tnr7_mc_1_0, ia_pal_isp_tnr7_mc_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_tnr7_spatial_1_1, ia_pal_isp_tnr7_spatial_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_upipe_1_0, ia_pal_isp_upipe_1_0_t) \
+    ENTRY(ia_pal_uuid_isp_image_upscaler_1_1, ia_pal_isp_upscaler_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_bgmap_upscaler_1_1, ia_pal_isp_upscaler_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_vcr_3_1, ia_pal_isp_vcr_3_1_t) \
+    ENTRY(ia_pal_uuid_isp_vcsc_2_0_b, ia_pal_isp_vcsc_2_0_t) \
+    ENTRY(ia_pal_uuid_isp_wb_1_1, ia_pal_isp_wb_1_1_t) \
+    ENTRY(ia_pal_uuid_isp_xnr_5_4, ia_pal_isp_xnr_5_4_t)
+
+/*!
+ * \brief Size and alignment of one ia_pal_isp_* parameter struct.
+ */
+typedef struct
+{
+    ia_pal_uuid uuid;   /*!< UUID of the kernel. */
+    uint32_t size;      /*!< Size of the parameter struct in bytes. */
+    uint32_t alignment; /*!< Alignment of the parameter struct in bytes. */
+} ia_pal_isp_parameters_info;
+
+#ifdef __cplusplus
+
+#define IA_PAL_ISP_PARAMETERS_INFO_ENTRY(uuid, type) \
+    { (uuid), static_cast<uint32_t>(sizeof(type)), static_cast<uint32_t>(alignof(type)) },
+
+/*!
+ * \brief Table of all known parameter structs, in ia_pal_uuid declaration order.
+ */
+static constexpr ia_pal_isp_parameters_info ia_pal_isp_parameters_info_table[] = {
+    IA_PAL_ISP_PARAMETERS_LIST(IA_PAL_ISP_PARAMETERS_INFO_ENTRY)
+};
+
+#undef IA_PAL_ISP_PARAMETERS_INFO_ENTRY
+
+/*!
+ * \brief Number of entries in ia_pal_isp_parameters_info_table.
+ */
+static constexpr uint32_t ia_pal_isp_parameters_info_count =
+    static_cast<uint32_t>(sizeof(ia_pal_isp_parameters_info_table) / sizeof(ia_pal_isp_parameters_info_table[0]));
+
+/*!
+ * \brief Find the table index of a kernel.
+ *
+ * \param[in] uuid Kernel UUID.
+ * \param[in] index (Optional) Start index of the search. Default is 0.
+ * \return Index into ia_pal_isp_parameters_info_table, ia_pal_isp_parameters_info_count if the
+ * UUID has no parameter struct.
+ */
+static constexpr uint32_t ia_pal_isp_parameters_find(ia_pal_uuid uuid, uint32_t index = 0U)
+{
+    return (index >= ia_pal_isp_parameters_info_count) ? ia_pal_isp_parameters_info_count :
+           ((ia_pal_isp_parameters_info_table[index].uuid == uuid) ? index :
+            ia_pal_isp_parameters_find(uuid, index + 1U));
+}
+
+/*!
+ * \brief Size of the parameter struct of a kernel.
+ *
+ * \param[in] uuid Kernel UUID.
+ * \return Size in bytes, 0 if the UUID has no parameter struct.
+ */
+static constexpr uint32_t ia_pal_isp_parameters_size(ia_pal_uuid uuid)
+{
+    return (ia_pal_isp_parameters_find(uuid) < ia_pal_isp_parameters_info_count) ?
+           ia_pal_isp_parameters_info_table[ia_pal_isp_parameters_find(uuid)].size : 0U;
+}
+
+/*!
+ * \brief Alignment of the parameter struct of a kernel.
+ *
+ * \param[in] uuid Kernel UUID.
+ * \return Alignment in bytes, 1 if the UUID has no parameter struct.
+ */
+static constexpr uint32_t ia_pal_isp_parameters_alignment(ia_pal_uuid uuid)
+{
+    return (ia_pal_isp_parameters_find(uuid) < ia_pal_isp_parameters_info_count) ?
+           ia_pal_isp_parameters_info_table[ia_pal_isp_parameters_find(uuid)].alignment : 1U;
+}
+
+/*!
+ * \brief Total size of the parameter structs of a kernel list laid out back to back,
+ * each one aligned to its own alignment.
+ *
+ * \param[in] uuids Kernel UUIDs.
+ * \param[in] count Number of UUIDs.
+ * \param[in] offset (Optional) Offset of the first struct. Default is 0.
+ * \return Total size in bytes including padding.
+ */
+static constexpr uint32_t ia_pal_isp_parameters_list_size(const ia_pal_uuid *uuids, uint32_t count, uint32_t offset = 0U)
+{
+    return (count == 0U) ? offset :
+           ia_pal_isp_parameters_list_size(uuids + 1, count - 1U,
+               (((offset + ia_pal_isp_parameters_alignment(*uuids) - 1U) / ia_pal_isp_parameters_alignment(*uuids)) *
+                ia_pal_isp_parameters_alignment(*uuids)) + ia_pal_isp_parameters_size(*uuids));
+}
+
+/*!
+ * \brief Total size of the parameter structs of a static kernel list.
+ *
+ * \param[in] uuids Kernel UUID array.
+ * \return Total size in bytes including padding.
+ */
+template <uint32_t N>
+static constexpr uint32_t ia_pal_isp_parameters_list_size(const ia_pal_uuid (&uuids)[N])
+{
+    return ia_pal_isp_parameters_list_size(uuids, N);
+}
+
+/*!
+ * \brief Usage example and self-check for a static kernel list.
+ */
+static constexpr ia_pal_uuid ia_pal_isp_parameters_example_list[] = {
+    ia_pal_uuid_isp_acm_1_2,
+    ia_pal_uuid_isp_sw_scaler,
+    ia_pal_uuid_isp_wb_1_1
+};
+static_assert(ia_pal_isp_parameters_list_size(ia_pal_isp_parameters_example_list) ==
+              (sizeof(ia_pal_isp_acm_1_2_t) + sizeof(ia_pal_isp_wb_1_1_t)),
+              "ia_pal_isp_parameters_list_size mismatch");
+
+#endif /* __cplusplus */
+
+#endif /* IA_PAL_TYPES_ISP_PARAMETERS_SIZE_H */